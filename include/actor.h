@@ -47,6 +47,16 @@
 	the left arm of the Actor, and consequently its left hand and fingers, but no other
 	bones that are not children of the affected bones will be changed.
 
+	Pose queries
+		The world space bone transforms and bounding boxes are computed the first time they are
+		queried after the pose changes, and kept until it changes again.  Only SetBody(),
+		ClearPose(), SetPose(), BlendPose(), the AnimationStep()/AnimationTestStep() family,
+		AnimationNudge(), SetScale(), SetBoneAttachment() and SetExtBox() change the pose or
+		what the queries read, so repeated GetBoneTransform(), GetBoneExtBox(),
+		GetBoneBoundingBox() and GetDynamicExtBox() calls between them are lookups.
+		Because a query may fill the cache, queries on one actor must not run on several threads
+		at once; different actors may be stepped and queried on different threads.
+
 
 */
 
@@ -113,6 +123,18 @@ struct Actor
 	/// with a NULL BoneName, this returns the current 'root' transform
 	bool GetBoneTransform(std::string BoneName, XForm *Transform);
 
+	/// Gets the index of the bone named BoneName for GetBoneTransformByIndex().
+	/// look it up once, it stays valid until the next SetBody()
+	/// returns false (and BoneIndex is not set) if there is no bone named BoneName
+	bool GetBoneIndex(std::string BoneName, int *BoneIndex);
+
+	/// GetBoneTransform() without the name lookup.  BoneIndex of GE_BODY_ROOT gets the 'root' transform
+	bool GetBoneTransformByIndex(int BoneIndex, XForm *Transform);
+
+	/// Returns a number that changes each time the pose changes (see 'Pose queries' above),
+	/// for callers that keep their own results derived from the pose.
+	uint32 GetPoseVersion() const;
+
 	/// Gets the extent box (axial-aligned bounding box) for a given bone (for the current pose)
 	/// if BoneName is NULL, gets the a general bounding box from the body of the actor if it has been set.
 	bool GetBoneExtBox(std::string BoneName, ExtBox *ExtBox);
@@ -276,6 +298,14 @@ struct Actor
 
 	/// Return data, if return value is true
 	bool GetAnimationEvent(std::string *ppEventString);
+
+	/// Gets all events fired by the cued motions during the last AnimationStep(), in time order.
+	/// MotionEvent::Time is in actor time, relative to the start of that step (0 .. the step's DeltaTime),
+	/// not the time within the motion, so events of different motions can be compared.
+	/// Events are collected during the step, so steps and queries on different actors may run on different threads.
+	/// @param Events set to the first event; valid until the next AnimationStep()
+	/// @return the number of events
+	int GetAnimationEvents(const MotionEvent **Events) const;
 };
 
 /// the deinition of an actor's geometry/bone structure
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "genesis.h"
+
+struct FrameBenchmarkSettings
+{
+	/// must have a driver and mode set
+	Engine *Engine;
+	/// already loaded, and added to Engine
+	World *World;
+
+	/// may be NULL for no actors
+	ActorDef *ActorDef;
+	int ActorCount;
+	/// each actor is cued with motion 0 of ActorDef
+	bool AnimateActors;
+
+	/// camera path, sampled at each frame's time
+	const Path *CameraPath;
+	float Fov;
+	Rect ScreenRect;
+
+	/// time step given to animation and the camera path, in seconds
+	float FrameTime;
+	/// frames run before measuring starts (texture uploads, caches)
+	int WarmupFrames;
+	int Frames;
+};
+
+struct FrameBenchmarkResult
+{
+	int Frames;
+	/// frame times in milliseconds
+	float Mean;
+	float P50;
+	float P90;
+	float P99;
+	float Max;
+	/// the counters summed over all measured frames, and the gauges; the memory high-water marks
+	/// are in Stats.GaugeHighWater (the MEMORY_ gauges)
+	StatsSnapshot Stats;
+};
+
+/// Headless, repeatable measurement of whole frames.
+/**
+ Takes a loaded World, adds ActorCount instances of an ActorDef, and flies a Camera along a Path,
+ calling Engine::BeginFrame, Engine::RenderWorld and Engine::EndFrame for each frame.
+ Time is fixed per frame (not read from the clock), so two runs on the same binary render
+ the same frames.  Use it with the null driver (DriverSystem::GetNullDriver), so the
+ numbers are engine CPU time rather than fill rate.
+*/
+struct FrameBenchmark
+{
+	FrameBenchmark(const FrameBenchmarkSettings *Settings);
+	~FrameBenchmark();
+
+	/// runs all the frames; turns the profiler on for the per-subsystem breakdown
+	bool Run(FrameBenchmarkResult *Result);
+
+	/// writes the result of the last Run as JSON: settings, percentiles, the time spent in
+	/// each profile zone, counters and memory high-water marks
+	bool WriteJSON(File *F) const;
+};
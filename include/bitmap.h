@@ -2,6 +2,7 @@
 
 #include "pixelformat.h"
 #include "vfile.h"
+#include "jobs.h"
 
 struct BitmapInfo
 {
@@ -16,6 +17,26 @@ struct BitmapInfo
 	BitmapPalette *Palette;
 };
 
+/// how BitmapPalette::CreateFromBitmapQuantized picks the colors
+enum class PaletteQuantizer
+{
+	/// what CreateFromBitmap(Bmp, false) does
+	FAST,
+	/// median cut over a k-d tree of the colors; best quality
+	MEDIAN_CUT,
+	/// octree reduction; lower quality than MEDIAN_CUT but much less memory on large images
+	OCTREE
+};
+
+/// error diffusion used when mapping pixels to a palette
+enum class PaletteDither
+{
+	NONE,
+	/// 4x4 Bayer matrix; stable between frames & mips
+	ORDERED,
+	FLOYD_STEINBERG
+};
+
 struct BitmapPalette
 {
 	BitmapPalette *Create(PixelFormat Format, int Size);
@@ -31,6 +52,23 @@ struct BitmapPalette
 	/// put Slow == TRUE for higher quality & slower
 	BitmapPalette *CreateFromBitmap(Bitmap *Bmp, bool Slow);
 
+	/// like CreateFromBitmap, but with a choice of quantizer and palette size (up to 256)
+	///	(this is a create, you must destroy later!)
+	static BitmapPalette *CreateFromBitmapQuantized(Bitmap *Bmp, PaletteQuantizer Quantizer, int Colors);
+
+	/// converts Count bitmaps to GE_PIXELFORMAT_8BIT_PAL, each with its own palette,
+	/// one bitmap per job on Jobs (NULL converts them all on the calling thread).  The nearest-color search is vectorized.
+	/// Palettes may be NULL; otherwise it receives a ref to each new palette (you must destroy them later!)
+	/// returns false if any of the bitmaps failed, the others are still converted
+	static bool QuantizeBitmaps(Bitmap **Bmps, int Count, PaletteQuantizer Quantizer, int Colors, PaletteDither Dither, BitmapPalette **Palettes, JobSystem *Jobs);
+
+	/// maps the pixels of Src onto this palette and writes them to Dst, which must be GE_PIXELFORMAT_8BIT_PAL
+	/// and the same size as Src.  Src and Dst may be the same bitmap.
+	bool MapBitmap(const Bitmap *Src, Bitmap *Dst, PaletteDither Dither) const;
+
+	/// peak signal to noise ratio (in dB) of Palettized compared to Original, for checking quantizer quality
+	static float ComputePSNR(const Bitmap *Original, const Bitmap *Palettized);
+
 	bool SortColors(BitmapPalette *P, bool Slower);
 
 	bool CreateRef(BitmapPalette *Palette);
@@ -73,6 +111,64 @@ struct BitmapPalette
 	bool GetEntry(const BitmapPalette *P, int Color, uint32 *Pixel);
 };
 
+/// on a file which is streaming, the sequence of returns looks like :
+///```
+///	IDLE
+///	CHANGED
+///	IDLE
+///	IDLE
+///	CHANGED
+///	...
+///	DONE
+///	NOT
+///	NOT
+///	NOT
+///	...
+///```
+/// Status >= STARTED means streaming has started & is in progress
+/// the user should never see STARTED or DATADONE
+enum class BitmapStreamingStatus
+{
+	ERROR = 0,
+	NOT,
+	STARTED,
+	IDLE,
+	CHANGED,
+	DATADONE,
+	DONE,
+};
+
+/// Settings for the codec behind GE_PIXELFORMAT_WAVELET (the storage version of a bitmap).
+struct WaveletOptions
+{
+	/// width and height of the tiles a mip is split into.
+	/// each tile is entropy coded on its own, so tiles can be decoded in parallel (see Jobs).
+	/// 0 codes the whole mip as one tile (smallest files, no parallel decode)
+	int TileSize;
+
+	/// tiles are decoded as JobLifetime::FREE jobs on Jobs (normally Engine::GetJobSystem);
+	/// NULL decodes on the calling thread
+	JobSystem *Jobs;
+
+	/// if true the coarse levels are decoded first and the finer levels stream in afterwards,
+	/// see Bitmap::GetStreamingStatus and Bitmap::GetFinestDecodedMip.
+	/// the finer levels are decoded by the jobs, so this is ignored when Jobs is NULL
+	bool Progressive;
+
+	/// 0..100 ; 100 is lossless
+	int Quality;
+};
+
+/// per mip lock state, see Bitmap::GetLockState
+enum class BitmapLockState
+{
+	UNLOCKED,
+	/// one or more LockForRead
+	READ,
+	/// one LockForWrite
+	WRITE
+};
+
 /**
  *
  * Before you can use a geBitmap in any module, you must add the geBitmap to that module first.  For example, if you were planning on using geEngine_DrawBitmap, you must first add the geBitmap to the geEngine module (see geEngine_AddBitmap).   Please note that adding a geBitmap to a geEngine module, does not allow you to use the geBitmap in other modules.  You must add the geBitmap to each and every module that you plan on using the geBitmap with.  Also note that you cannot add a geBitmap to a geEngine, while in the middle of a drawing frame (in between calls to geEngine_BeginFrame, and geEngine_EndFrame)
@@ -86,15 +182,29 @@ struct BitmapPalette
  *		doing different SetPalettes with different palettes on different locked mips
  *		has undefined behavior!
  *
+ * threading : CreateRef, Destroy and the Lock/UnLock functions may be called from any thread.
+ *	the reference count is atomic, and each mip keeps its own reader/writer lock state,
+ *	so different threads may lock different mips of the same bitmap at once.
+ *	functions that change the whole bitmap (SetFormat, SetPalette, SetMipCount, ...) need
+ *	every mip unlocked and fail otherwise.
+ *
  **/
 struct Bitmap
 {
 	static Bitmap *Create(int Width, int Height, int MipCount, PixelFormat Format);
+
+	/// atomic, may be called from any thread
 	void CreateRef();
 
 	static Bitmap *CreateFromInfo(const BitmapInfo *pInfo);
 
 	static Bitmap *CreateFromFile(File *F);
+
+	/// like CreateFromFile, but a GE_PIXELFORMAT_WAVELET file is decoded as described by Options.
+	/// with Options->Progressive (and Options->Jobs set) the bitmap returns as soon as the coarsest mip
+	/// is decoded, poll GetStreamingStatus to see the finer levels arrive.  Otherwise all mips are decoded before it returns.
+	/// Options may be NULL for the engine defaults.
+	static Bitmap *CreateFromFileWavelet(File *F, const WaveletOptions *Options);
 	static Bitmap *CreateFromFileName(const File *BaseFS, std::string Name);
 	bool WriteToFile(File *F) const;
 
@@ -103,6 +213,7 @@ struct Bitmap
 	bool WriteToFileName(const File *BaseFS, std::string Name) const;
 
 	/// returns whether Bmp was actually destroyed : not success/failure
+	/// atomic, may be called from any thread; only the thread that drops the last reference frees the bitmap
 	bool Destroy();
 
 	/// LockForWrite returns data in Info's format
@@ -121,21 +232,35 @@ struct Bitmap
 	/// a non-exclusive lock
 	/// not really const, stores lock-count, but *data* is const
 	/// will do a format conversion!
+	/// blocks while another thread holds any mip in [MinimumMip,MaximumMip] for write
 	bool LockForRead(Bitmap **Target, int MinimumMip, int MaximumMip, PixelFormat Format, bool RespectColorKey, uint32 ColorKey) const;
 
 	/// lock for read in a format that gaurantee no conversions
 	/// then do GetInfo on the locks to see what you have!
+	/// blocks like LockForRead
 	bool LockForReadNative(Bitmap **Target, int MinimumMip, int MaximumMip) const;
 
 	/// an exclusive lock
+	/// blocks while another thread holds any mip in [MinimumMip,MaximumMip] for read or write
 	bool LockForWrite(Bitmap **Target, int MinimumMip, int MaximumMip);
 
 	/// Format must be one of the two returned in GetInfo !!
+	/// blocks like LockForWrite
 	bool LockForWriteFormat(Bitmap **Target, int MinimumMip, int MaximumMip, PixelFormat Format);
 
+	/// like the Lock functions above, but fail at once instead of blocking
+	/// when a mip in [MinimumMip,MaximumMip] is held for write (or for read, for the write locks) by another thread
+	bool TryLockForRead(Bitmap **Target, int MinimumMip, int MaximumMip, PixelFormat Format, bool RespectColorKey, uint32 ColorKey) const;
+	bool TryLockForReadNative(Bitmap **Target, int MinimumMip, int MaximumMip) const;
+	bool TryLockForWrite(Bitmap **Target, int MinimumMip, int MaximumMip);
+	bool TryLockForWriteFormat(Bitmap **Target, int MinimumMip, int MaximumMip, PixelFormat Format);
+
 	/// must be done on All locked mips
 	bool UnLock();
 
+	/// the state of one mip; only a hint when other threads lock the bitmap
+	BitmapLockState GetLockState(int Mip) const;
+
 	/// _SetFormat may cause you to lose color information!
 	/// SetFormat does a conversion!
 	/// if NewFormat is palettized and Palette is NULL, we create a palette for the bitmap!
@@ -202,6 +327,29 @@ struct Bitmap
 	/// Destroy all mips (except the first)! use with care! this is not polite!
 	bool ClearMips();
 
+	/// the options used when the storage version is (re)compressed with SetFormat(GE_PIXELFORMAT_WAVELET,...)
+	/// or written with WriteToFile.
+	bool SetWaveletOptions(const WaveletOptions *Options);
+	bool GetWaveletOptions(WaveletOptions *Options) const;
+
+	/// see BitmapStreamingStatus for the sequence of returns on a streaming bitmap
+	BitmapStreamingStatus GetStreamingStatus() const;
+
+	/// the smallest mip index that is fully decoded, mips from here up to the coarsest (BitmapInfo::MaximumMip)
+	/// may be locked & drawn.  0 once streaming is DONE; returns -1 if nothing is decoded yet
+	int GetFinestDecodedMip() const;
+
+	/// mips [FinestResidentMip,CoarsestResidentMip] are currently in memory.
+	/// bitmaps not handled by a TextureStreamer always have all their mips resident
+	void GetResidentMips(int *FinestResidentMip, int *CoarsestResidentMip) const;
+
+	/// bytes used by the resident mips (primary and secondary)
+	uint32 GetResidentBytes() const;
+
+	/// TextureStreamer never evicts Mip or any coarser mip of this bitmap.
+	/// overrides TextureStreamer::SetResidentTailMips for this bitmap; -1 (default) uses SetResidentTailMips
+	void SetMinimumResidentMip(int Mip);
+
 	/// Shortcuts
 	int Width() const;
 	int Height() const;
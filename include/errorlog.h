@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <string_view>
+
 typedef enum
 {
 	/// Driver not supported
@@ -213,6 +216,21 @@ enum class ErrorClassType
 	SEARCH_FAILURE,
 };
 
+/// one logged error; fixed size so the log is a ring buffer of these with no allocation when adding.
+/// the error class, id string, file and line are kept as an index into the interned site table
+/// (see ErrorLog::RegisterSite); Context and UserString are copied in, truncated to fit
+struct ErrorRecord
+{
+	/// from ErrorLog::RegisterSite
+	uint32 Site;
+	/// how many identical errors (same site, context and user string) were folded into this record
+	uint32 RepeatCount;
+	/// the Context given to Error_Add
+	char Context[32];
+	/// Error_AddString's string
+	char UserString[48];
+};
+
 struct ErrorLog
 {
 	/// clears error history
@@ -224,20 +242,56 @@ struct ErrorLog
 	/// not intended to be used directly: use Error_Add or Error_AddString
 	static void AddExplicit(ErrorClassType, std::string ErrorIDString, std::string ErrorFileString, int LineNumber, std::string UserString, std::string Context);
 
-	/// adds text to the previous logged error
+	/// not intended to be used directly: use Error_Add or Error_AddString
+	/// interns the error class, id string and file name of one Error_Add site and returns its index.
+	/// called once per site (the macros keep the result in a static)
+	static uint32 RegisterSite(ErrorClassType Error, const char *ErrorIDString, const char *ErrorFileString, int LineNumber);
+
+	/// not intended to be used directly: use Error_Add or Error_AddString
+	/// lock-free and safe to call from any number of threads.  Does not allocate.
+	/// UserString and Context are copied into the record (see ErrorRecord), so they may be
+	/// literals, std::strings or stack buffers.  When the ring buffer is full the oldest record is overwritten.
+	static void AddSite(uint32 Site, std::string_view UserString, std::string_view Context);
+
+	/// an error identical to one logged less than Seconds ago (same site, context and user string)
+	/// bumps that record's RepeatCount instead of adding a new record.  0 turns this off.
+	static void SetRepeatWindow(float Seconds);
+
+	/// number of records kept; older ones are overwritten.  Not thread safe, call at startup.
+	static void SetCapacity(int Records);
+
+	/// number of records overwritten because the ring was full since the last Clear
+	static int DroppedCount(void);
+
+	/// adds text to the UserString of the last error logged by the calling thread, truncated to fit.
+	/// returns false if this thread has logged nothing, or its record has been overwritten since
 	static bool AppendString(std::string String);
 
 	/// reports from the error log.
 	/// history is 0 for most recent,  1.. for second most recent etc.
 	/// returns true if report succeeded.  false if it failed.
 	static bool Report(int History, ErrorClassType *Error, std::string *UserString);
+
+	/// like Report, but copies out the whole record and gives the formatted site (id, file and line).
+	/// the site string is built here, not when the error was added.  Error and SiteString may be NULL.
+	static bool ReportRecord(int History, ErrorRecord *Record, ErrorClassType *Error, std::string *SiteString);
 };
 
 /// 'Debug' version includes a textual error id, and the user string
 /// 'Release' version does not include the textual error id, or the user string
 
 /// logs an error.
-#define Error_Add(Error, Context) ErrorLog::AddExplicit(Error, #Error, __FILE__, __LINE__, "", Context)
+#define Error_Add(Error, Context) \
+	do \
+	{ \
+		static const uint32 ErrorSite = ErrorLog::RegisterSite(Error, #Error, __FILE__, __LINE__); \
+		ErrorLog::AddSite(ErrorSite, "", Context); \
+	} while (0)
 
 /// logs an error with additional identifing string.
-#define Error_AddString(Error, String, Context) ErrorLog::AddExplicit(Error, #Error, __FILE__, __LINE__, String, Context)
+#define Error_AddString(Error, String, Context) \
+	do \
+	{ \
+		static const uint32 ErrorSite = ErrorLog::RegisterSite(Error, #Error, __FILE__, __LINE__); \
+		ErrorLog::AddSite(ErrorSite, String, Context); \
+	} while (0)
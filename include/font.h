@@ -31,6 +31,24 @@ enum class FontFlag
     JUSTIFY_CENTER = 0x00000010,
 };
 
+/// per frame text statistics, see Font::GetFrameStats()
+struct FontStats
+{
+    /// glyphs sent to the screen
+    int32 GlyphsDrawn;
+    /// glyphs found in the atlas / glyphs that had to be rendered into it
+    int32 GlyphCacheHits;
+    int32 GlyphCacheMisses;
+    /// glyphs thrown out of the atlas to make room (least recently used first)
+    int32 GlyphsEvicted;
+    /// DrawText() calls whose laid out run was reused from the run cache
+    int32 RunCacheHits;
+    /// RenderPolyArray submissions made by Flush(), including the early ones forced by eviction
+    int32 Batches;
+    /// times a queued glyph had to be evicted, so the pending batch was flushed first
+    int32 EvictionFlushes;
+};
+
 /// An instance of a font.
 /// Bitmapped font support interface.
 /// This implementation supports any TrueType fonts provided by Windows
@@ -65,6 +83,20 @@ struct Font
     /// @return true if success, false if  failure
     bool AddCharacters(unsigned char leastIndex, unsigned char mostIndex);
 
+    /// Like AddCharacters(), but for any unicode code point range (inclusive).
+    /// Glyphs are packed into the font's atlas.  When the atlas is full the least recently
+    /// drawn glyphs are evicted and rendered again when next needed, so large ranges
+    /// (CJK, etc) don't need to fit all at once.  Glyphs queued by DrawText() and not yet
+    /// flushed are pinned: if only pinned glyphs are left to evict, the pending batch is
+    /// flushed first, so it never draws from a rect that has been reused.
+    /// @return true if success, false if  failure
+    bool AddCodePoints(uint32 leastCodePoint, uint32 mostCodePoint);
+
+    /// Sets the size of the glyph atlas bitmap.  Defaults to 512x512.
+    /// Resizing throws out all cached glyphs and text runs.
+    /// @return true if success, false if  failure
+    bool SetAtlasSize(const uint32 width, const uint32 height);
+
     /// destroys any valid "scratch-pad" buffer attached to the Font.
     /// you'll rarely need to call this function; it's called by Destroy() anyway.
     /// Calling this function with a Font that has no initialized buffer doesn't
@@ -85,14 +117,20 @@ struct Font
 
     /// This is the function you put between Engine::BeginFrame() and Engine::EndFrame(), the function that draws text to the screen.
     /// IF the font has NO characters in it (added by AddCharacters() ) then a different, more windows-intensive way is used to draw out the characters.
-    /// Assuming you've added characters to the font, characters which have NOT been added
-    /// WILL cause an assert if you try to draw them.
+    /// Assuming you've added characters to the font, characters outside the ranges added with
+    /// AddCharacters() or AddCodePoints() WILL cause an assert if you try to draw them.
+    /// Characters in those ranges that were evicted from the atlas are simply rendered into it again.
     /// Only GE_FONTSET_WORDWRAP is meaningfull right now.  Using any other flags will cause
     /// an assert.
     /// As stated above, you can use an entirely different way of creating a string, by
     /// making a font with no characters in it.  This
     /// jumps through Windows DIB hoops, and draws the text in a non-anti-aliased, but
     /// (hopefully) more unicode-tolerant way (DrawText() ).
+    /// textString is UTF-8; the laid out run is cached by string, rect and flags, so drawing the same
+    /// text again skips the layout.  A cached run is checked again against the atlas after any
+    /// eviction, and its evicted glyphs are rendered back before it is queued.
+    /// Glyphs are queued, not drawn: all text of the frame goes out in one batch at Flush()
+    /// (or in more than one, if the atlas fills up during the frame, see AddCodePoints()).
     /// @param textString - pointer to the text string to output to the screen.
     /// @param rect - screen rectangle to place the text within.
     /// @param Color - RGB color the text should be.
@@ -101,10 +139,19 @@ struct Font
     /// @return true if success, false if  failure
     bool DrawText(std::string textString, const Rect *rect, const Rgba *Color, FontFlag flags, const Rect *clipRect);
 
+    /// Submits all text queued by DrawText() since the last Flush() as one RenderPolyArray batch.
+    /// Engine::EndFrame() flushes every font, call this only if text must be drawn before something else.
+    /// @return true if success, false if  failure
+    bool Flush();
+
+    /// Fills Stats with the counts of the last finished frame.
+    void GetFrameStats(FontStats *Stats) const;
+
     /// This is the function you put between Engine::BeginFrame() and Engine::EndFrame(), the function that draws text to the screen.
     /// IF the font has NO characters in it (added by AddCharacters() ) then a different, more windows-intensive way is used to draw out the characters.
-    /// Assuming you've added characters to the font, characters which have NOT been added
-    /// WILL cause an assert if you try to draw them.
+    /// Assuming you've added characters to the font, characters outside the ranges added with
+    /// AddCharacters() or AddCodePoints() WILL cause an assert if you try to draw them.
+    /// Characters in those ranges that were evicted from the atlas are simply rendered into it again.
     /// Only GE_FONTSET_WORDWRAP is meaningfull right now.  Using any other flags will cause
     /// an assert.
     /// As stated above, you can use an entirely different way of creating a string, by
@@ -147,6 +194,9 @@ struct Font
 
     bool GetCharMap(uint8 character, Rect *rect, Bitmap **targetBitmap, int32 *fullWidth, int32 *fullHeight, int32 *offsetX, int32 *offsetY);
 
+    /// GetCharMap() for any code point.  targetBitmap is the atlas; the rect is only valid until the glyph is evicted.
+    bool GetCodePointMap(uint32 codePoint, Rect *rect, Bitmap **targetBitmap, int32 *fullWidth, int32 *fullHeight, int32 *offsetX, int32 *offsetY);
+
     void EnableAntialiasing(const bool anti);
     bool IsAntialiased();
 };
\ No newline at end of file
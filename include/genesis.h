@@ -13,6 +13,10 @@
 #include "actor.h"
 #include "path.h"
 #include "motion.h"
+#include "profile.h"
+#include "stats.h"
+#include "jobs.h"
+#include "physicssystem.h"
 
 using HWND = int;
 
@@ -30,7 +34,7 @@ All drawing API's should be called AFTER geEngine_BeginFrame, and BEFORE geEngin
 struct Engine
 {
 	/** Creates a geEngine object.
-	@param hWnd Handle to the window that should belong to Genesis. This window handle will be what Genesis receives it's focus from. In a window video mode (see geEngine_SetDriverAndMode), it will also be what is rendered into.
+	@param hWnd Handle to the window that should belong to Genesis. This window handle will be what Genesis receives it's focus from. In a window video mode (see geEngine_SetDriverAndMode), it will also be what is rendered into. MAY BE NULL (0) if only the null driver will be used (see DriverSystem::GetNullDriver); SetDriverAndMode then fails for every other driver.
 	@param DriverDirectory The directory where the geEngine object will look for drivers upon creation.
 	@returns a valid geEngine object if the function succeeds, NULL otherwise.
 	 *
@@ -55,6 +59,7 @@ struct Engine
 
 	/** Adds a geBitmap to a geEngine object, and increases the reference count of the geBitmap object by one.
 	 * A geBitmap can be added to a geEngine more than once.
+	 * The reference count is atomic, so the bitmap may be shared with streaming or loading threads.
 		@param bitmap The geBitmap object that will be added to the geEngine object.
 		@return true is the function succeeds, false otherwise
 	*/
@@ -109,6 +114,13 @@ struct Engine
 	*/
 	bool Printf(int32 x, int32 y, std::string String, ...);
 
+	/** Like Printf, but for text that does not change from frame to frame. The text is laid out once and the cached run is drawn until it changes.
+		@param x 	Specifies the row (in pixel space) of the starting point of the text.
+		@param y 	Specifies the column (in pixel space) of the starting point of the text.
+		@return true is the function succeeds, false otherwise.
+	*/
+	bool PrintString(int32 x, int32 y, std::string String);
+
 	/** Renders a poly to the current active back-buffer using the geEngine object supplied. If there is more than one back-buffer, the poly will not be seen, until the next call to geEngine_EndFrame is called, and the buffer is made visible. This function must be called AFTER geEngine_BeginFrame, and BEFORE geEngine_EndFrame.
 		@param World The geWorld that is the container for the Texture being used for this operation.
 		@param Points Pointer to an array of vertices that define the winding of the poly.
@@ -166,19 +178,123 @@ struct Engine
 		@return true is the function succeeds, false otherwise.
 	*/
 	void EnableFrameRateCounter(bool Enabled);
+
+	/** Turns the timing zones (see profile.h) on or off. Off by default; zones cost almost nothing while off.
+		@param Frames How many finished frames of zones to keep.
+	*/
+	void EnableProfiler(bool Enabled, int Frames);
+
+	/** Gets the zones timed during a finished frame, from all threads.
+		@param History 0 for the last finished frame, 1.. for older frames.
+		@param Events Array that receives up to MaxEvents zones, in order of start time. May be NULL to only get the count.
+		@param Count Receives the number of zones in that frame.
+		@return true is the function succeeds, false if profiling is off or History is older than what is kept.
+	*/
+	bool GetProfileFrame(int History, ProfileEvent *Events, int MaxEvents, int *Count) const;
+
+	/** Writes all kept frames as Chrome trace event JSON (load it in chrome://tracing or Perfetto).
+		@return true is the function succeeds, false otherwise.
+	*/
+	bool WriteProfileTrace(File *F) const;
+
+	/** Gets the counters and gauges (see stats.h) as they were at the end of the last finished frame.
+		@return true is the function succeeds, false if no frame has finished yet.
+	*/
+	bool GetStatsSnapshot(StatsSnapshot *Snapshot) const;
 	bool Activate(bool bActive);
 	bool UpdateWindow();
+
+	/// the streaming manager for all bitmaps added to this engine and its worlds, see TextureStreamer
+	TextureStreamer *GetTextureStreamer();
+
+	/// the worker threads every subsystem of this engine queues its work on, see jobs.h
+	JobSystem *GetJobSystem();
+};
+
+struct TextureStreamerStats
+{
+	/// bytes of all resident mips of all streamed bitmaps
+	uint32 ResidentBytes;
+	/// bytes requested this frame that did not fit in the budget
+	uint32 PendingBytes;
+	/// mips loaded/evicted during the last Update
+	int MipsLoaded;
+	int MipsEvicted;
+};
+
+/** Keeps the mips of streamed bitmaps inside a global memory budget.
+ * A bitmap starts with only its coarsest mips resident. Each Update, the finer mips of bitmaps that
+ * were visible in the last render (World::BitmapIsVisible) are requested according to how large they appear on screen,
+ * and the mips of bitmaps that have not been used for a while are evicted when the budget is exceeded.
+ * Loads run as JobLifetime::FREE jobs on the engine's JobSystem; watch Bitmap::GetStreamingStatus and
+ * Bitmap::GetResidentMips for progress.
+ */
+struct TextureStreamer
+{
+	/// the total bytes of resident mips the streamer tries to stay under, 0 means no limit
+	void SetBudget(uint32 Bytes);
+	uint32 GetBudget() const;
+
+	/// bitmap will be streamed; it is not streamed unless added.
+	/// Bitmap must have been created from a file so its mips can be fetched again, and that file
+	/// must stay open until RemoveBitmap (or until the streamer is destroyed).
+	/// increases the reference count of the bitmap by one.
+	bool AddBitmap(Bitmap *Bitmap);
+	bool RemoveBitmap(Bitmap *Bitmap);
+
+	/// the number of mips always kept resident, counted from the coarsest (default 1).
+	/// a bitmap's own Bitmap::SetMinimumResidentMip, if set, is used instead
+	void SetResidentTailMips(int Count);
+
+	/// Call once per frame for each rendered view, after Engine::RenderWorld of that view and before Engine::EndFrame,
+	/// so World::BitmapIsVisible reflects this Camera.  decides which mips to fetch and which to evict from the
+	/// visible bitmaps of World as seen from Camera; the mips it fetches are drawn from a later frame on.
+	bool Update(World *World, const Camera *Camera);
+
+	/// blocks until every request issued so far has been loaded (loading screens, screenshots)
+	bool Flush();
+
+	bool GetStats(TextureStreamerStats *Stats) const;
 };
 
 struct DriverSystem
 {
 	Driver *GetNextDriver(Driver *Start);
+
+	/// Gets the driver that draws nothing, see Driver::IsNull. It is not returned by GetNextDriver.
+	Driver *GetNullDriver();
+};
+
+/// what the null driver was asked to do, see Driver::GetNullDriverStats
+struct NullDriverStats
+{
+	int32 RenderPolyCalls;
+	int32 RenderPolyArrayCalls;
+	int32 Polys;
+	int32 Vertices;
+	int32 DrawBitmapCalls;
+	int32 FillRectCalls;
+	/// calls that failed validation (bad vertex counts, bitmaps not added to the engine, NAN's, ...)
+	int32 InvalidCalls;
 };
 
 struct Driver
 {
 	DriverMode *GetNextMode(DriverMode *Start);
 	bool GetName(std::string *Name);
+
+	/// true for the null driver. It accepts and validates every RenderPoly, RenderPolyArray, DrawBitmap
+	/// and FillRect call, counts it and throws it away, so the whole submission path runs with no rasterization.
+	/// Its modes need no window; use it for servers and CPU benchmarks.  GetNextMode enumerates
+	/// 640x480, 800x600, 1024x768, 1280x720 and 1920x1080, GetNullMode makes a mode of any other size.
+	bool IsNull() const;
+
+	/// a mode of Width x Height for SetDriverAndMode, owned by the driver.
+	/// returns NULL if this is not the null driver or either size is not positive
+	DriverMode *GetNullMode(int32 Width, int32 Height);
+
+	/// the counts of the last finished frame; returns false if this is not the null driver
+	bool GetNullDriverStats(NullDriverStats *Stats) const;
 };
 
 struct DriverMode
@@ -187,19 +303,75 @@ struct DriverMode
 	bool GetWidthHeight(int32 *Width, int32 *Height);
 };
 
+struct SoundSystemStats
+{
+	/// all sounds that are playing, real or virtual
+	int32 PlayingVoices;
+	/// voices that were resampled and mixed in the last mix
+	int32 RealVoices;
+	/// voices that are playing but too low in the order (or too quiet) to be mixed; they only advance their position
+	int32 VirtualVoices;
+};
+
+/** The sound system mixes all playing sounds in software, resampling and mixing into float buses with SIMD.
+ * Only the first sounds up to the real voice cap are mixed, ordered by priority (highest first) and, within
+ * equal priority, by volume (loudest first). The others become virtual: they cost nothing but keep their
+ * play position, and become real again when they move up the order.
+ */
 struct SoundSystem
 {
 	static SoundSystem *Create(HWND hWnd);
+
+	/// Creates a sound system with no output device; the mix is only made by RenderOffline. For tests and servers.
+	static SoundSystem *CreateOffline(int32 SampleRate, int32 Channels);
+
 	void Destroy();
 	bool SetMasterVolume(float Volume);
 
 	SoundDef *LoadSound(File *file);
+
+	/// Like LoadSound, but only a ring buffer of BufferBytes of decoded samples is kept in memory;
+	/// the rest is read and decoded from file as the sound plays, by JobLifetime::FREE jobs on the
+	/// JobSystem set with SetJobSystem (or during the mix if none is set).
+	/// Reads PCM and IMA ADPCM wave files; ADPCM is decoded on the fly.
+	/// file must stay open until the SoundDef is freed, and must not be read by anything else meanwhile.
+	/// Each Play of a streamed SoundDef reads the file from its own position; refills of all its plays are
+	/// serialized on the SoundDef (each one seeks and reads while holding it), so use it for music and long
+	/// voice lines, not for sounds that play many times at once.
+	/// @param BufferBytes 0 uses the default (64k)
+	SoundDef *LoadSoundStreamed(File *file, int32 BufferBytes);
+
+	/// the job system that refills streamed sounds (see LoadSoundStreamed), normally Engine::GetJobSystem.
+	/// NULL (default) refills them on the mixing thread
+	void SetJobSystem(JobSystem *Jobs);
+
+	/// the most voices mixed at once, the rest are virtual. Defaults to 64
+	bool SetMaxRealVoices(int32 Count);
+
+	/// voices quieter than this (0..1, after master volume) are virtual. Defaults to 0.001
+	bool SetVirtualVolumeThreshold(float Volume);
+
+	/// mixes the next Frames sample frames into Buffer (interleaved floats, Channels per frame).
+	/// only for a sound system made with CreateOffline
+	bool RenderOffline(float *Buffer, int32 Frames);
+
+	void GetStats(SoundSystemStats *Stats) const;
 };
 
 struct SoundDef
 {
 	void Free();
 	Sound *Play(float Volume, float Pan, float Frequency, bool Loop);
+
+	/// Play with a priority (Play uses 0); when more voices play than can be mixed, lower priority sounds go
+	/// virtual first, and sounds of equal priority go virtual quietest first (see SoundSystem)
+	Sound *PlayWithPriority(float Volume, float Pan, float Frequency, bool Loop, int32 Priority);
+
+	/// true if loaded with SoundSystem::LoadSoundStreamed
+	bool IsStreamed() const;
+
+	/// bytes of sample data in memory: the whole sound, or the ring buffers of a streamed sound
+	int32 GetResidentBytes() const;
 };
 
 struct Sound
@@ -207,6 +379,27 @@ struct Sound
 	bool StopSound();
 	bool ModifySound(float Volume, float Pan, float Frequency);
 	bool SoundIsPlaying();
+
+	/// true if the sound is playing but not being mixed, see SoundSystem
+	bool SoundIsVirtual();
+};
+
+/// one sound position for World::GetSound3dConfigArray
+struct Sound3dEmitter
+{
+	vec3f Position;
+	/// the Min parameter of World::GetSound3dConfig
+	float Min;
+	/// 0 for an emitter that moves; otherwise a number unique to this emitter, that never moves
+	uint32 StaticId;
+};
+
+/// the results of World::GetSound3dConfig for one emitter
+struct Sound3dConfig
+{
+	float Volume;
+	float Pan;
+	float Frequency;
 };
 
 /**
@@ -215,18 +408,29 @@ struct Sound
 struct World
 {
 	World(File *file);
+	/// does not clear sweep callbacks set with SetPhysicsCollision, call ClearPhysicsCollision first
 	~World();
 
 	// sound
 	void GetSound3dConfig(const XForm *CameraTransform, const vec3f *SoundPos, float Min, float Ds, float *Volume, float *Pan, float *Frequency) const;
 	void GetSound3dConfigIgnoreObstructions(const XForm *MXForm, const vec3f *SndPos, float Min, float Ds, float *Volume, float *Pan, float *Frequency) const;
 
+	/// GetSound3dConfig for Count emitters at once. The distance and pan math is vectorized, and the obstruction
+	/// tests are traced together so they share BSP node visits. Obstruction results of static emitters
+	/// (StaticId != 0) are kept and only traced again when the camera moves to another leaf.
+	/// @param IgnoreObstructions  true gives the results of GetSound3dConfigIgnoreObstructions
+	void GetSound3dConfigArray(const XForm *CameraTransform, const Sound3dEmitter *Emitters, int32 Count, float Ds, bool IgnoreObstructions, Sound3dConfig *Configs);
+
+	/// forgets the kept obstruction results of static emitters (after a model such as a door moved)
+	void ClearSound3dCache();
+
 	// World Actors
 	bool RemoveActor(Actor *Actor);
 	bool AddActor(Actor *Actor, ActorFlag Flags, uint32 UserFlags);
 	bool SetActorFlags(Actor *Actor, ActorFlag Flags);
 
 	// World Bitmaps
+	/// increases the reference count of the bitmap by one (atomic)
 	bool AddBitmap(Bitmap *Bitmap);
 	bool RemoveBitmap(Bitmap *Bitmap);
 	bool HasBitmap(const Bitmap *Bitmap) const;
@@ -261,6 +465,23 @@ struct World
 	bool Collision(const vec3f *Mins, const vec3f *Maxs, const vec3f *Front, const vec3f *Back, ContentsFlag Contents, CollisionFlag CollideFlags, uint32 UserFlags, CollisionCB *CollisionCB, void *Context, Collision *Col);
 	bool GetContents(const vec3f *Pos, const vec3f *Mins, const vec3f *Maxs, CollisionFlag Flags, uint32 UserFlags, CollisionCB *CollisionCB, void *Context, Contents *Contents);
 
+	/// Makes the objects of System (that have continuous collision on) collide with this world, by setting
+	/// a PhysicsSweepCB that calls Collision with each object's Mins and Maxs.
+	/// This replaces any sweep callback already set with PhysicsSystem::SetSweepCallback
+	/// (a system sweeps against one world only).
+	/// @param Contents  Contents to collide with (use GE_CONTENTS_SOLID_CLIP for default)
+	/// @param CollideFlags  To mask out certain object types (GE_COLLIDE_ALL, etc...)
+	/// @param UserFlags  To mask out actors (refer to geActor_SetUserFlags)
+	bool SetPhysicsCollision(PhysicsSystem *System, ContentsFlag Contents, CollisionFlag CollideFlags, uint32 UserFlags);
+
+	/// Removes the sweep callback SetPhysicsCollision set on System, turning its continuous collision off.
+	/// The callback is only cleared if PhysicsSystem::GetSweepCallback still returns this world's
+	/// callback with this world as its Context; otherwise (the user has set another one since, or
+	/// another world did) it is left alone and false is returned.
+	/// Call this before the world is destroyed: ~World does not know the systems it was set on,
+	/// and a system left pointing at a destroyed world crashes on its next Iterate.
+	bool ClearPhysicsCollision(PhysicsSystem *System);
+
 	// World Polys
 	Poly *AddPolyOnce(LitVertex *Verts, int32 NumVerts, Bitmap *Bitmap, Poly_Type Type, uint32 RenderFlags, float Scale);
 	Poly *AddPoly(LitVertex *Verts, int32 NumVerts, Bitmap *Bitmap, Poly_Type Type, uint32 RenderFlags, float Scale);
@@ -0,0 +1,76 @@
+#pragma once
+
+typedef void JobFunction(void *Context);
+
+/// does the items [Begin,End) of a parallel for
+typedef void JobRangeFunction(void *Context, int Begin, int End);
+
+enum class JobLifetime
+{
+	/// may run across frames (loading, mip generation)
+	FREE,
+	/// must be done by Engine::EndFrame
+	FRAME
+};
+
+struct JobSystemStats
+{
+	/// jobs waiting in all queues
+	int32 QueueDepth;
+	int32 JobsRun;
+	/// jobs taken from another worker's queue
+	int32 Steals;
+	int32 StealAttempts;
+	int32 WorkerCount;
+};
+
+/// a queued job, see JobSystem::Add
+struct Job
+{
+	/// Job will not be queued until Dependency has finished. Only valid before Submit
+	bool AddDependency(Job *Dependency);
+
+	/// queues the job (once its dependencies are done). The Job may not be used after Submit except with Wait or IsDone.
+	bool Submit();
+
+	bool IsDone() const;
+
+	/// runs other jobs on this thread until this one is done; don't call it from inside a job, use a continuation
+	void Wait();
+};
+
+/// Engine-owned worker threads shared by all subsystems.
+/**
+ There is one JobSystem per Engine (Engine::GetJobSystem); animation, culling, collision batches,
+ mip generation and loading all queue their work here instead of starting threads of their own.
+ Each worker has its own queue and steals from the others when it runs dry.
+
+ A job may have dependencies: it is queued when all of them have finished.  Work that has to
+ wait for other work inside a job should be split into a continuation (a job that depends on
+ the work) rather than waiting, so no worker ever blocks.
+
+ Jobs added with JobLifetime::FRAME must be finished by Engine::EndFrame, which waits for them.
+*/
+struct JobSystem
+{
+	/// creates a job; it is not run until Job::Submit
+	Job *Add(JobFunction *Function, void *Context, JobLifetime Lifetime);
+
+	/// splits [0,Count) into ranges of at least MinRange items and runs them on the workers.
+	/// returns a job that is done when all the ranges are done; like Add, it must be submitted
+	Job *AddParallelFor(JobRangeFunction *Function, void *Context, int Count, int MinRange, JobLifetime Lifetime);
+
+	/// runs Function over [0,Count) and returns when it is done; the calling thread helps.
+	/// it blocks like Job::Wait, so don't call it from inside a job (e.g. an island solve job):
+	/// use AddParallelFor there and put the rest of the work in a job that depends on it
+	void ParallelFor(JobRangeFunction *Function, void *Context, int Count, int MinRange);
+
+	/// the number of worker threads (the calling thread not included)
+	int GetWorkerCount() const;
+
+	/// 0 picks one per core less one.  Can't be called while jobs are queued
+	bool SetWorkerCount(int Count);
+
+	/// since the last call of Engine::EndFrame
+	void GetStats(JobSystemStats *Stats) const;
+};
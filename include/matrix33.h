@@ -0,0 +1,47 @@
+#pragma once
+
+#include "xform3d.h"
+
+/// Pure 3x3 matrix
+struct Matrix33
+{
+	float x[3][3];
+
+	/// copies this into C
+	void Copy(Matrix33 *C) const;
+	void SetIdentity();
+	void Add(const Matrix33 *M2, Matrix33 *Res) const;
+	void Subtract(const Matrix33 *M2, Matrix33 *Res) const;
+	void MultiplyVec3d(const vec3f *V, vec3f *Res) const;
+	void Multiply(const Matrix33 *M2, Matrix33 *Res) const;
+	void MultiplyScalar(float S, Matrix33 *Res) const;
+	void GetTranspose(Matrix33 *T) const;
+	void GetInverse(Matrix33 *Inv) const;
+
+	/// makes M such that M*A == V cross A
+	static void MakeCrossProductMatrix33(const vec3f *V, Matrix33 *M);
+
+	/// the rotation (upper 3x3) part of XForm
+	static void ExtractFromXForm3d(const XForm *XForm, Matrix33 *M);
+
+	/// inverse of a symmetric matrix (an inertia tensor), from the cofactors of the 6 unique elements.
+	/// returns false (and Inv is not set) if the matrix is singular
+	bool GetSymmetricInverse(Matrix33 *Inv) const;
+
+	/// R * I * R^T, the inertia tensor I turned into the frame of the rotation R, computed as a symmetric matrix.
+	/// use this with the body-space inverse tensor to get the world-space inverse without inverting again
+	static void RotateSymmetric(const Matrix33 *R, const Matrix33 *I, Matrix33 *Res);
+
+	/// batched versions: Res[i] = op(M1[i], M2[i]) for i in [0,Count).
+	/// vectorized across matrices; the arrays may not overlap
+	static void MultiplyArray(const Matrix33 *M1, const Matrix33 *M2, Matrix33 *Res, int Count);
+	static void MultiplyVec3dArray(const Matrix33 *M, const vec3f *V, vec3f *Res, int Count);
+
+	/// Inv[i] = inverse of M[i]; a singular M[i] gives a zero matrix in Inv[i].
+	/// returns the number of singular matrices (0 if all were inverted)
+	static int GetInverseArray(const Matrix33 *M, Matrix33 *Inv, int Count);
+	static int GetSymmetricInverseArray(const Matrix33 *M, Matrix33 *Inv, int Count);
+
+	static void RotateSymmetricArray(const Matrix33 *R, const Matrix33 *I, Matrix33 *Res, int Count);
+	static void MakeCrossProductMatrix33Array(const vec3f *V, Matrix33 *M, int Count);
+};
@@ -1,5 +1,13 @@
 #pragma once
 
+/// one event of a motion, see Motion::GetEvents
+struct MotionEvent
+{
+	float Time;
+	/// the interned event string, see Motion::GetEventString
+	uint32 EventId;
+};
+
 /// Motion interface.
 ///	This object is a list of named Path objects
 struct Motion
@@ -12,6 +20,75 @@ struct Motion
 	bool SetName(std::string Name);
 	std::string GetName() const;
 
+	/// support for compound motions.  A motion can either have sub-motions, or be single motion.
+	/// these functions support motions that have sub-motions.
+	int GetSubMotionCount() const;
+
+	/// the returned motions from these Get functions should not be destroyed.
+	Motion *GetSubMotion(int Index) const;
+	Motion *GetSubMotionNamed(std::string Name) const;
+
+	/// @param TimeScale Scale factor for this submotion
+	/// @param TimeOffset Time in parent motion when submotion should start
+	/// @param StartTime Blend start time (relative to submotion)
+	/// @param StartMagnitude Blend start magnitude (0..1)
+	/// @param EndTime Blend ending time (relative to submotion)
+	/// @param EndMagnitude Blend ending magnitude (0..1)
+	/// @param Transform Base transform to apply to this submotion
+	/// @param Index returned motion index
+	bool AddSubMotion(float TimeScale, float TimeOffset, Motion *SubMotion, float StartTime, float StartMagnitude, float EndTime, float EndMagnitude, const XForm *Transform, int *Index);
+
+	Motion *RemoveSubMotion(int SubMotionIndex);
+
+	/// Get/Set submotion time offset.  The time offset is the offset into the
+	/// compound (parent) motion at which the submotion should start.
+	float GetTimeOffset(int SubMotionIndex) const;
+	bool SetTimeOffset(int SubMotionIndex, float TimeOffset);
+
+	/// Get/Set submotion time scale.  Time scaling is applied to the submotion after the TimeOffset
+	/// is applied.  The formula is:  (CurrentTime - TimeOffset) * TimeScale
+	float GetTimeScale(int SubMotionIndex) const;
+	bool SetTimeScale(int SubMotionIndex, float TimeScale);
+
+	/// Get blending amount for a particular submotion.  The Time parameter is parent-relative.
+	float GetBlendAmount(int SubMotionIndex, float Time) const;
+
+	/// Get/Set blending path.  The keyframe times in the blend path are relative to the submotion.
+	Path *GetBlendPath(int SubMotionIndex) const;
+	bool SetBlendPath(int SubMotionIndex, Path *Blend);
+
+	const XForm *GetBaseTransform(int SubMotionIndex) const;
+	bool SetBaseTransform(int SubMotionIndex, XForm *BaseTransform);
+
+	/// flattens a compound motion into a new single motion (you must destroy it) with one path per joint.
+	/// each joint is sampled SamplesPerSecond times a second over GetTimeExtents(), and keys that
+	/// linear/slerp interpolation can rebuild within Tolerance (world units and radians) are dropped.
+	/// the baked motion samples the same (within Tolerance) as this one, but at the cost of a single motion.
+	/// the events of this motion and of every sub-motion are copied, their times mapped into this
+	/// motion's time with each sub-motion's offset and scale applied.
+	Motion *Bake(float SamplesPerSecond, float Tolerance) const;
+
+	/// a number that changes whenever this motion changes: its paths' keys (see Path::GetVersion),
+	/// its events, its sub-motions, or (recursively) anything in its sub-motions.
+	/// a motion doesn't know its parents, so this is gathered from the sub-motions when asked
+	uint32 GetVersion() const;
+
+	/// on a motion made by Bake(): bakes again only the keys of Compound in [StartTime,EndTime]
+	bool Rebake(const Motion *Compound, float StartTime, float EndTime);
+
+	/// on a motion made by Bake(): bakes again the parts of Compound that changed since this motion was
+	/// last baked from it, and does nothing if none changed.
+	/// Adding, removing or changing a sub-motion of Compound (its offset, scale, blend path or base
+	/// transform) adds the parent time ranges it covered before and after the change to Compound's
+	/// change log, tagged with the new GetVersion().  The log holds the last 32 ranges; when it is full
+	/// the two oldest are merged into the one range covering both, so it never grows and a motion baked
+	/// long ago rebakes a larger range rather than missing a change.  The baked motion keeps the version
+	/// of Compound and of each sub-motion it was baked from; it rebakes the time ranges in Compound's
+	/// change log newer than that version, and the whole range of each sub-motion whose version differs
+	/// (which catches edits made through GetSubMotion()->GetPath()).
+	/// Compound is not changed, so any number of motions baked from it can each be brought up to date.
+	bool RebakeChanged(const Motion *Compound);
+
 	/// gets time of first key and time of last key (as if motion did not loop)
 	/// if there are no paths in the motion: returns false and times are not set
 	/// otherwise returns true
@@ -44,6 +121,20 @@ struct Motion
 	/// @param ppEventString Return data, if found
 	bool GetNextEvent(float *pTime, std::string *ppEventString);
 
+	/// Gets the events in [StartTime,EndTime) without any iterator state, so it may be called
+	/// from many threads at once.  The events are kept sorted by time, with their strings interned.
+	/// @param Events set to the first event in the range; valid until an event is inserted or deleted
+	/// @return the number of events in the range
+	int GetEvents(float StartTime, float EndTime, const MotionEvent **Events) const;
+
+	/// the string of an interned event id (shared by all motions); empty for an id never handed out
+	static std::string GetEventString(uint32 EventId);
+
+	/// the id an event string is interned as, to compare against MotionEvent::EventId without strings.
+	/// a string no motion uses yet is interned and gets a new id, so ids can be looked up before
+	/// the motions are loaded.  Ids never change.  Safe to call from any thread.
+	static uint32 GetEventId(std::string EventString);
+
 	/// returns the time associated with the first and last events
 	/// returns false if there are no events (and Times are not set)
 	bool GetEventExtents(float *FirstEventTime, float *LastEventTime) const;
@@ -28,6 +28,11 @@ enum class PathInterpolation
 };
 
 /// Time-indexed keyframe creation, maintenance, and sampling.
+/**
+ The hermite tangents of translation keys and the SQUAD control quaternions (the `Quat::Ln`/`Exp`
+ part) of rotation keys are computed when keys are inserted, deleted or modified, and when a path is
+ loaded.  Sampling is then a polynomial evaluation between two keys, with no per sample tangents.
+*/
 struct Path
 {
 
@@ -56,9 +61,11 @@ struct Path
 	bool WriteToBinaryFile(File *F) const;
 
 	/// inserts a keyframe at a specific time.
+	/// recomputes the tangents/control quaternions of the new key and its neighbours.
 	bool InsertKeyframe(ChannelMask channelMask, float Time, const XForm *Matrix);
 
 	/// deletes the nth keyframe
+	/// recomputes the tangents/control quaternions of the neighbours.
 	bool DeleteKeyframe(int Index, ChannelMask channelMask);
 
 	/// gets the time for the first and last keys in the path (ignoring looping)
@@ -73,6 +80,10 @@ struct Path
 	/// @param Matrix returns the matrix of the keyframe
 	void GetKeyframe(int Index, ChannelMask Channel, float *Time, XForm *Matrix) const;
 
+	/// a number that changes whenever a keyframe is inserted, deleted, changed or moved in time
+	/// (OffsetTimes), see Motion::GetVersion
+	uint32 GetVersion() const;
+
 	/// retrieves count of keyframes for a specific channel
 	int GetKeyframeCount(ChannelMask Channel) const;
 
@@ -84,13 +95,28 @@ struct Path
 	/// p is not const because information is cached in p for next sample
 	XForm Sample(float Time) const;
 
+	/// samples Count paths at the same Time into Results[i].
+	/// the keys around Time are gathered into SoA form and evaluated together with SIMD,
+	/// so this is much faster than calling Sample on each path (e.g. all bones of a motion).
+	static void SampleArray(const Path *const *Paths, int Count, float Time, XForm *Results);
+
+	/// samples Count paths at the same Time, like SampleArray, but returns each path's rotation
+	/// and translation separately instead of a combined transform.
+	/// @param Rotations receives the rotation of Paths[i] at Time in Rotations[i]
+	/// @param Translations receives the translation of Paths[i] at Time in Translations[i]
+	static void SampleChannelsArray(const Path *const *Paths, int Count, float Time, Quat *Rotations, vec3f *Translations);
+
 protected:
 	/// returns a rotation and a translation for the path at 'Time'
 	/// p is not const because information is cached in p for next sample
 	void SampleChannels(float Time, Quat *Rotation, vec3f *Translation) const;
 
 	/// slides all samples in path starting with StartingIndex down by TimeOffset
+	/// recomputes the tangents/control quaternions of the keys at the shift boundary
+	/// (StartingIndex-1 and StartingIndex), whose spacing changes.
 	bool OffsetTimes(int StartingIndex, ChannelMask channelMask, float TimeOffset);
 
+	/// replaces the nth keyframe
+	/// recomputes the tangents/control quaternions of the key and its neighbours.
 	bool ModifyKeyframe(int Index, ChannelMask channelMask, const XForm *Matrix);
 };
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "physicsobject.h"
+
+enum class PhysicsJointKind
+{
+	/// pins Object1 to a point in the world
+	WORLD = 0,
+	/// ball and socket between Object1 and Object2
+	SPHERICAL,
+	PTTOPATH,
+	PTTOSURFACE
+};
+
+/// Rigid body joint
+struct PhysicsJoint
+{
+	PhysicsJoint(PhysicsJointKind Kind, const vec3f *Location, float assemblyRate, PhysicsObject *PS1, PhysicsObject *PS2, float physicsScale);
+	~PhysicsJoint();
+
+	PhysicsJointKind GetType() const;
+	void GetLocationA(vec3f *pLoc) const;
+	void GetLocationB(vec3f *pLoc) const;
+	void SetLocationA(const vec3f *pLoc);
+	void SetLocationB(const vec3f *pLoc);
+	void GetLocationAInWorldSpace(vec3f *pLoc) const;
+	void GetLocationBInWorldSpace(vec3f *pLoc) const;
+	void SetLocationAInWorldSpace(const vec3f *pLoc);
+	void SetLocationBInWorldSpace(const vec3f *pLoc);
+	PhysicsObject *GetObject1() const;
+	PhysicsObject *GetObject2() const;
+	float GetAssemblyRate() const;
+	void SetAssemblyRate(float assemblyRate);
+};
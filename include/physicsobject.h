@@ -0,0 +1,123 @@
+#pragma once
+
+#include "xform3d.h"
+#include "quatern.h"
+#include "matrix33.h"
+
+#define PHYSICSOBJECT_GRAVITY (-3.9f)
+
+/// Constrained rigid body.
+/// the state (location, orientation, velocities, forces) is kept once per config;
+/// configIndex selects which copy a function reads or writes, see PhysicsSystem::GetSourceConfigIndex
+/// once added to a PhysicsSystem the state lives in the system's arrays, and the Get/Set functions
+/// here read and write the object's element of them
+struct PhysicsObject
+{
+	PhysicsObject(const vec3f *StartLocation,
+				  float mass,
+				  bool IsAffectedByGravity,
+				  bool RespondsToForces,
+				  float linearDamping,
+				  float angularDamping,
+				  const vec3f *Mins,
+				  const vec3f *Maxs,
+				  float physicsScale);
+	~PhysicsObject();
+
+	bool ApplyGlobalFrameForce(vec3f *force, vec3f *radiusVector, bool isAppliedForce, int configIndex);
+	bool ApplyGlobalFrameImpulse(vec3f *pImpulse, vec3f *pRadVec, int configIndex);
+	/// prefer PhysicsSystem::ComputeForces and PhysicsSystem::Integrate, which do all objects at once
+	bool ComputeForces(int configIndex);
+	bool Integrate(float deltaTime, int SourceConfigIndex);
+
+	/// the index of this object in PhysicsStateArrays, -1 if not added to a system
+	int GetBodyIndex() const;
+
+	float GetMass() const;
+	void SetMass(float mass);
+
+	float GetOneOverMass() const;
+
+	void GetXForm(XForm *xform, int configIndex) const;
+	void SetXForm(const XForm *xform, int configIndex);
+
+	void GetXFormInEditorSpace(XForm *xform, int configIndex) const;
+
+	void GetOriginalLocation(vec3f *loc) const;
+	void SetOriginalLocation(const vec3f *loc);
+
+	void GetLocation(vec3f *Location, int configIndex) const;
+	void GetLocationInEditorSpace(vec3f *loc, int configIndex) const;
+
+	void GetLinearVelocity(vec3f *vel, int configIndex) const;
+	void SetLinearVelocity(const vec3f *vel, int configIndex);
+
+	void GetAngularVelocity(vec3f *vel, int configIndex) const;
+	void SetAngularVelocity(const vec3f *vel, int configIndex);
+
+	void GetForce(vec3f *force, int configIndex) const;
+	void SetForce(const vec3f *force, int configIndex);
+
+	void GetTorque(vec3f *torque, int configIndex) const;
+	void SetTorque(const vec3f *torque, int configIndex);
+
+	void GetAppliedForce(vec3f *force, int configIndex) const;
+	void SetAppliedForce(const vec3f *force, int configIndex);
+
+	void GetAppliedTorque(vec3f *torque, int configIndex) const;
+	void SetAppliedTorque(const vec3f *torque, int configIndex);
+
+	void ClearForce(int configIndex);
+	void ClearTorque(int configIndex);
+
+	void ClearAppliedForce(int configIndex);
+	void ClearAppliedTorque(int configIndex);
+
+	void IncForce(const vec3f *forceInc, int configIndex);
+	void IncTorque(const vec3f *torqueInc, int configIndex);
+
+	void IncAppliedForce(const vec3f *forceInc, int configIndex);
+	void IncAppliedTorque(const vec3f *torqueInc, int configIndex);
+
+	void GetOrientation(Quat *orient, int configIndex) const;
+	void SetOrientation(const Quat *orient, int configIndex);
+
+	void GetInertiaTensor(Matrix33 *iTensor) const;
+	void GetInertiaTensorInverse(Matrix33 *iTensorInv) const;
+
+	void GetInertiaTensorInPhysicsSpace(Matrix33 *pITensor, int configIndex) const;
+
+	/// R * Iinv * R^T with the body-space inverse cached at SetMass; no inverse is taken per call
+	void GetInertiaTensorInverseInPhysicsSpace(Matrix33 *pITensorInv, int configIndex) const;
+
+	bool IsAffectedByGravity() const;
+	void SetIsAffectedByGravity(bool flag);
+
+	bool RespondsToForces() const;
+	void SetRespondsToForces(bool flag);
+
+	float GetLinearDamping() const;
+	void SetLinearDamping(float linearDamping);
+
+	float GetAngularDamping() const;
+	void SetAngularDamping(float angularDamping);
+
+	void SetActiveConfig(int configIndex);
+	int GetActiveConfig();
+
+	void SetPhysicsScale(float scale);
+	float GetPhysicsScale();
+
+	/// sweep this object against the world each step, see PhysicsSystem::SetSweepCallback.  Off by default
+	void SetContinuousCollision(bool Enable);
+	bool GetContinuousCollision() const;
+
+	/// how contacts from continuous collision respond: Restitution 0 (no bounce) .. 1, Friction 0 (none) ..
+	void SetContactProperties(float Restitution, float Friction);
+
+	/// true while the island of this object is asleep, see PhysicsSystem
+	bool IsAsleep() const;
+
+	/// wakes the whole island of this object
+	void WakeUp();
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "physicsobject.h"
+#include "physicsjoint.h"
+#include "jobs.h"
+
+/// how PhysicsSystem solves for the joint constraint forces
+enum class PhysicsSolver
+{
+	/// builds and solves the full matrix of all constraints: exact, but cost grows with the cube of the constraint count
+	DENSE,
+	/// LDL^T factorization ordered along the joint graph; exact, cost grows about linearly for chains and trees
+	SPARSE_LDLT,
+	/// projected Gauss-Seidel (sequential impulses), warm started from the previous step; approximate, linear cost
+	GAUSS_SEIDEL
+};
+
+struct PhysicsSolverStats
+{
+	/// sum of the constraint dimensions solved in the last Iterate
+	int Constraints;
+	/// Gauss-Seidel sweeps done in the last Iterate (0 for the direct solvers)
+	int Iterations;
+	/// largest constraint error (joint drift) left after the last Iterate
+	float MaxError;
+};
+
+/// the state of every object of a PhysicsSystem in one config, as one array per component.
+/// element i belongs to the object with PhysicsObject::GetBodyIndex() == i.
+/// the arrays are padded to a multiple of 8 and 32 byte aligned, so they can be walked with SIMD
+struct PhysicsStateArrays
+{
+	int Count;
+	float *LocationX, *LocationY, *LocationZ;
+	float *OrientationW, *OrientationX, *OrientationY, *OrientationZ;
+	float *LinearVelocityX, *LinearVelocityY, *LinearVelocityZ;
+	float *AngularVelocityX, *AngularVelocityY, *AngularVelocityZ;
+	float *ForceX, *ForceY, *ForceZ;
+	float *TorqueX, *TorqueY, *TorqueZ;
+	float *AppliedForceX, *AppliedForceY, *AppliedForceZ;
+	float *AppliedTorqueX, *AppliedTorqueY, *AppliedTorqueZ;
+
+	/// the rest are the same for all configs
+	float *OneOverMass;
+	float *LinearDamping;
+	float *AngularDamping;
+	/// 1.0 if the object IsAffectedByGravity, else 0.0
+	float *GravityScale;
+	/// 1.0 if the object RespondsToForces, else 0.0
+	float *ForceScale;
+	/// the body-space inverse inertia tensor, row major: InertiaInverse[r][c][i] is element (r,c) of object i
+	float *InertiaInverse[3][3];
+};
+
+/// where a swept object first touched something, see PhysicsSweepCB
+struct PhysicsContact
+{
+	/// Impact Point (in world-space)
+	vec3f Impact;
+	/// surface normal at the impact, pointing towards the object
+	vec3f Normal;
+	/// Percent from 0 to 1.0, how far along the move for the impact point
+	float Ratio;
+};
+
+/// sweeps the box Mins/Maxs (object-space) of Object from Front to Back (world-space).
+/// returns true and fills Contact for the first thing hit, false if the move is clear.
+/// World::SetPhysicsCollision installs one that uses World::Collision
+typedef bool PhysicsSweepCB(const PhysicsObject *Object, const vec3f *Mins, const vec3f *Maxs, const vec3f *Front, const vec3f *Back, void *Context, PhysicsContact *Contact);
+
+/// Rigid body, constraint based physics system
+/**
+ Objects that are connected through joints (directly or through other objects) form an island.
+ Islands don't affect each other, so Iterate solves each island on its own, on the workers of
+ the JobSystem if one is set.  An island whose objects have all stayed below the sleep
+ thresholds for long enough goes to sleep and is skipped until one of its objects is woken
+ (by a force, an impulse, a Set* call, or a joint to an awake island being added).
+
+ With a sweep callback set, every awake object with continuous collision on is swept on every
+ step, from where it was to where it is integrated to, however short the move.  A move of zero
+ length is still passed to the callback (Front == Back), which then tests the box for overlap,
+ so resting and slowly pushed objects are held by the geometry too.  The callback does the broad
+ check itself: World's culls by whether the ExtBox::LinearSweep box of the move touches any world
+ geometry, and only then calls World::Collision.  A hit moves the object back to the impact and the
+ contact is added to the solver as a one sided constraint for that step, so fast objects don't
+ tunnel through walls and large steps need no substepping.
+*/
+struct PhysicsSystem
+{
+	PhysicsSystem();
+	~PhysicsSystem();
+
+	/// steps every awake island by Time
+	bool Iterate(float Time);
+
+	/// islands are solved as jobs of Jobs, NULL (default) solves them all on the calling thread
+	void SetJobSystem(JobSystem *Jobs);
+
+	/// an object is at rest when its linear and angular speeds stay under these for RestTime seconds;
+	/// an island sleeps when all its objects are at rest.  A RestTime of 0 turns sleeping off.
+	void SetSleepThresholds(float LinearSpeed, float AngularSpeed, float RestTime);
+
+	/// islands are found again after joints or objects are added
+	int GetIslandCount() const;
+
+	/// the index of the island Object is in, -1 if it is not in this system
+	int GetObjectIsland(const PhysicsObject *Object) const;
+
+	bool IsIslandAsleep(int Island) const;
+	void WakeIsland(int Island);
+
+	bool AddJoint(PhysicsJoint *Joint);
+	/// the system takes over the object's state; from here on the object's accessors read and write
+	/// the system's arrays (see GetStateArrays)
+	bool AddObject(PhysicsObject *Object);
+
+	int GetSourceConfigIndex() const;
+	PhysicsObject **GetPhysobs() const;
+	PhysicsJoint **GetPhysjnts() const;
+	int GetNumPhysobs() const;
+	int GetNumPhysjnts() const;
+	int GetSumOfConstraintDimensions() const;
+
+	/// SPARSE_LDLT is the default. Iterations and Tolerance are only used by GAUSS_SEIDEL, which stops when
+	/// the largest change of a constraint force in a sweep is under Tolerance, or after Iterations sweeps.
+	void SetSolver(PhysicsSolver Solver, int Iterations, float Tolerance);
+	PhysicsSolver GetSolver() const;
+
+	void GetSolverStats(PhysicsSolverStats *Stats) const;
+
+	/// the arrays stay valid until an object is added or removed
+	bool GetStateArrays(int configIndex, PhysicsStateArrays *Arrays);
+
+	/// PhysicsObject::ComputeForces for all objects at once
+	bool ComputeForces(int configIndex);
+
+	/// PhysicsObject::Integrate for all objects at once, vectorized over the state arrays
+	bool Integrate(float deltaTime, int SourceConfigIndex);
+
+	/// bytes needed by SaveSnapshot; changes when objects or joints are added
+	int GetSnapshotSize() const;
+
+	/// copies the whole simulation state into Buffer:
+	///	- the source config index and each object's active config
+	///	- all PhysicsStateArrays of the source config: location, orientation, linear and angular
+	///	  velocity, force, torque, applied force and applied torque
+	///	- the per-body values that can be changed after creation: mass, damping, gravity and
+	///	  responds-to-forces flags, physics scale, original location, the continuous collision
+	///	  flag and the contact restitution and friction
+	///	- joint locations (A and B) and assembly rates
+	///	- the solver warm start (last constraint forces)
+	///	- rest timers and island sleep state
+	/// The snapshot holds no pointers: it may be memcpy'd,
+	/// kept in a ring of past frames, and restored into this system (or one built the same way).
+	/// returns false if Size is too small
+	bool SaveSnapshot(void *Buffer, int Size) const;
+
+	/// puts the system back in the state saved by SaveSnapshot, ready to Iterate again
+	bool RestoreSnapshot(const void *Buffer, int Size);
+
+	/// in deterministic mode, Iterate gives bitwise identical results for identical input on the same
+	/// binary: islands and constraints are solved in a fixed order whatever the worker count,
+	/// and no reductions are reordered between runs.  Slightly slower; off by default
+	void SetDeterministic(bool Deterministic);
+	bool IsDeterministic() const;
+
+	/// NULL (default) turns continuous collision off for the whole system
+	void SetSweepCallback(PhysicsSweepCB *Callback, void *Context);
+	/// the callback and context last set with SetSweepCallback (NULL if none); either pointer may be NULL
+	void GetSweepCallback(PhysicsSweepCB **Callback, void **Context) const;
+};
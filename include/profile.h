@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+
+/// where a zone is; one static per zone, made by GE_PROFILE_ZONE
+struct ProfileZoneInfo
+{
+	const char *Name;
+	const char *File;
+	int Line;
+};
+
+/// one timed run of a zone on one thread
+struct ProfileEvent
+{
+	const ProfileZoneInfo *Zone;
+	uint32 ThreadId;
+	/// nesting level on its thread; 0 is outermost
+	int Depth;
+	/// in seconds since the start of the frame
+	double Start;
+	double End;
+};
+
+/// the out of line part of the zones; use GE_PROFILE_ZONE rather than this directly
+struct Profiler
+{
+	/// set by Engine::EnableProfiler; read by every zone, on any thread, with relaxed loads
+	static std::atomic<bool> Enabled;
+
+	static void BeginZone(const ProfileZoneInfo *Zone);
+	static void EndZone();
+};
+
+/// Times a scope (a CPU timing zone); use GE_PROFILE_ZONE rather than this directly.
+/**
+ Put GE_PROFILE_ZONE("Name") at the top of a scope to time it.  Each thread writes the zones it
+ enters into its own ring buffer, without locks, and the engine collects them at Engine::EndFrame.
+ When profiling is off (see Engine::EnableProfiler) a zone costs one load and a predictable branch,
+ as ProfileZone is inline and only tests Profiler::Enabled.  A zone entered while profiling was
+ off is not timed, even if profiling is turned on before it ends.
+
+ The engine itself times these zones:
+ ```
+ Engine::BeginFrame
+ Engine::RenderWorld
+     RenderWorld.Vis
+     RenderWorld.Actors
+     RenderWorld.WorldPolys
+ Engine::EndFrame
+ World::Collision
+ Actor::AnimationStep
+ Load
+ ```
+*/
+struct ProfileZone
+{
+	bool Active;
+
+	ProfileZone(const ProfileZoneInfo *Zone)
+		: Active(Profiler::Enabled.load(std::memory_order_relaxed))
+	{
+		if (Active)
+			Profiler::BeginZone(Zone);
+	}
+
+	~ProfileZone()
+	{
+		if (Active)
+			Profiler::EndZone();
+	}
+};
+
+#define GE_PROFILE_CONCAT2(A, B) A##B
+#define GE_PROFILE_CONCAT(A, B) GE_PROFILE_CONCAT2(A, B)
+
+/// times from here to the end of the enclosing scope, Name must be a literal
+#define GE_PROFILE_ZONE(Name) \
+	static const ProfileZoneInfo GE_PROFILE_CONCAT(ProfileZoneInfo_, __LINE__) = {Name, __FILE__, __LINE__}; \
+	ProfileZone GE_PROFILE_CONCAT(ProfileZone_, __LINE__)(&GE_PROFILE_CONCAT(ProfileZoneInfo_, __LINE__))
@@ -2,6 +2,27 @@
 
 #include "xform3d.h"
 
+/// how Quat::SlerpArray and Quat::SlerpSoA interpolate, see the error bounds in the Quat overview
+enum class QuatSlerpMode
+{
+	/// same as Slerp
+	EXACT,
+	/// same as SlerpNotShortest
+	EXACT_NOT_SHORTEST,
+	/// corrected normalized lerp
+	FAST,
+	/// normalized lerp
+	NLERP
+};
+
+/// Count quaternions with one array per component
+struct QuatSoA
+{
+	float *W;
+	float *X, *Y, *Z;
+	int Count;
+};
+
 /// Quaternion mathematical system interface.
 /**
 The quatern module contains basic support for a quaternion object.
@@ -71,6 +92,23 @@ since `q == -q`, care must be taken to rotate the proper way.
 
 this implementation uses the notation `quaternion q = (quatS,quatV)`
 	where `quatS` is a scalar, and `quatV` is a 3 element vector.
+
+approximate interpolation (see QuatSlerpMode) - slerp needs an `acos` and
+three `sin`s per sample.  the approximations avoid them:
+
+`NLERP` interpolates each component and normalizes.  the result is on the
+right arc, but moves along it at a non-constant speed.  the error (angle between
+the result and exact slerp, as a rotation) is at most 0.00058 radians for
+keys up to 30 degrees apart, and at most 0.143 radians (8.2 degrees) for keys
+180 degrees apart.
+
+`FAST` corrects `t` with a cubic in `t` whose coefficients are a polynomial in
+`q1 dot q2`, then does `NLERP`.  the error is at most 0.00078 radians (0.045
+degrees) for any pair of keys.
+
+batches - the *Array functions do `Count` independent operations on arrays of
+quaternions, the *SoA functions do the same on QuatSoA (one array per component),
+which lets them use the full SIMD width.
 */
 struct Quat
 {
@@ -120,6 +158,33 @@ struct Quat
 	/// with t==0 being all q0, and t==1 being all q1.
 	static void SlerpNotShortest(const Quat *Q0, const Quat *Q1, float T, Quat *QT);
 
+	/// Slerp approximated without trigonometry, error at most 0.00078 radians.  takes the shortest route like Slerp
+	static void SlerpFast(const Quat *Q0, const Quat *Q1, float T, Quat *QT);
+
+	/// normalized linear interpolation.  takes the shortest route like Slerp.
+	/// fine for keys that are close together, see the error bounds above
+	static void Nlerp(const Quat *Q0, const Quat *Q1, float T, Quat *QT);
+
+	/// QT[i] = slerp of Q0[i] and Q1[i] at T[i], for i in [0,Count)
+	static void SlerpArray(const Quat *Q0, const Quat *Q1, const float *T, Quat *QT, int Count, QuatSlerpMode Mode);
+
+	/// QProduct[i] = Q1[i] * Q2[i]
+	static void MultiplyArray(const Quat *Q1, const Quat *Q2, Quat *QProduct, int Count);
+
+	/// VRotated[i] = V[i] rotated by Q[i]
+	static void RotateArray(const Quat *Q, const vec3f *V, vec3f *VRotated, int Count);
+
+	/// normalizes each of Q in place
+	static void NormalizeArray(Quat *Q, int Count);
+
+	/// RotationMatrixDest[i] = ToMatrix of Q[i]; like ToMatrix, any translation in RotationMatrixDest[i] is lost
+	static void ToMatrixArray(const Quat *Q, XForm *RotationMatrixDest, int Count);
+
+	/// the same as the *Array functions, on QuatSoA.  all the QuatSoA must have the same Count
+	static void SlerpSoA(const QuatSoA *Q0, const QuatSoA *Q1, const float *T, QuatSoA *QT, QuatSlerpMode Mode);
+	static void MultiplySoA(const QuatSoA *Q1, const QuatSoA *Q2, QuatSoA *QProduct);
+	static void NormalizeSoA(QuatSoA *Q);
+
 	/// multiplies q1 * q2, and places the result in q.
 	/// no failure. 	renormalization not automatic
 	void Multiply(const Quat *Q2, Quat *QProduct) const;
@@ -0,0 +1,71 @@
+#pragma once
+
+enum class StatCounter
+{
+	/// polys handed to the driver (world, actors, RenderPoly)
+	POLYS_SUBMITTED,
+	/// texels copied to the driver
+	TEXELS_UPLOADED,
+	/// World::Collision and World::GetContents calls
+	COLLISION_QUERIES,
+	BSP_NODES_VISITED,
+	ACTORS_SKINNED,
+	/// bytes read through any FileSystem, see FileSystem::GetBytesRead for one file system
+	FILE_BYTES_READ,
+	/// allocations made by each subsystem, matching the MEMORY_ gauges
+	ALLOCATIONS_BITMAP,
+	ALLOCATIONS_WORLD,
+	ALLOCATIONS_ACTOR,
+	ALLOCATIONS_SOUND,
+	ALLOCATIONS_OTHER,
+	JOBS_RUN,
+	/// jobs a worker took from another worker's queue
+	JOB_STEALS,
+
+	COUNT
+};
+
+enum class StatGauge
+{
+	/// bytes currently allocated by each subsystem
+	MEMORY_BITMAP,
+	MEMORY_WORLD,
+	MEMORY_ACTOR,
+	MEMORY_SOUND,
+	MEMORY_OTHER,
+	/// jobs waiting in the JobSystem queues
+	JOB_QUEUE_DEPTH,
+
+	COUNT
+};
+
+struct StatsSnapshot
+{
+	uint32 Counters[(int)StatCounter::COUNT];
+	uint32 Gauges[(int)StatGauge::COUNT];
+	/// highest value each gauge has reached since the engine was created
+	uint32 GaugeHighWater[(int)StatGauge::COUNT];
+};
+
+/// Engine-wide counters and gauges.
+/**
+ Counters only go up during a frame and are reset at each Engine::EndFrame; gauges hold a level
+ (bytes in use, etc) until set again.  Increments go to a per-thread shard and are summed when a
+ snapshot is taken, so counting from many threads does not contend.  Available in release builds.
+*/
+struct Stats
+{
+	/// adds to this thread's shard of the counter; lock-free
+	static void Add(StatCounter Counter, uint32 Amount);
+
+	static void SetGauge(StatGauge Gauge, uint32 Value);
+	/// Amount may be negative
+	static void AddGauge(StatGauge Gauge, int32 Amount);
+
+	/// sums all shards.  During a frame the counters are the totals so far;
+	/// use Engine::GetStatsSnapshot for a whole frame.
+	static void GetSnapshot(StatsSnapshot *Snapshot);
+
+	static std::string GetName(StatCounter Counter);
+	static std::string GetName(StatGauge Gauge);
+};
@@ -108,6 +108,10 @@ struct FileSystem
 
 	/// closes and destroys the File
 	bool Close();
+
+	/// total bytes read from files opened through this file system.
+	/// wraps around at 4GB, so only use the difference between two calls
+	uint32 GetBytesRead() const;
 };
 
 // Finder (Directory)